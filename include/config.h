@@ -1,40 +1,175 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
-// Pin definitions
-#define ENCODER_CLK 2
-#define ENCODER_DT  3
-#define ENCODER_SW  10
-#define FAN_PIN 5
-#define HEATER_PIN 21
-#define VAPORIZER_PIN 0
-
-// I2C configuration for BME280
-#define BME280_I2C_ADDRESS 0x76  // Default I2C address for BME280
-
-// Control constants
-#define FAN_PWM_FREQ_SOFT 10 // Software PWM frequency in Hz
-#define FAN_PWM_MIN 0       // Minimum PWM for slow operation
-#define FAN_PWM_START 50    // PWM value to start the fan (kick-start)
-#define FAN_PWM_MAX 255       // Max PWM
-#define FAN_KICK_START_DURATION 1000 // Kick-start duration in milliseconds
-#define HEATER_PWM_MIN 0      // No minimum for heater
-#define HEATER_PWM_MAX 255    // Max PWM for heater
-#define TEMP_THRESHOLD_LOW 1  // Minimum degrees below target to turn on heater
+#include <stdint.h>
+
+// Marks an output that is not fitted on a board
+constexpr int NO_PIN = -1;
+
+// Board descriptions: pin map and sensor bus
+
+// v1.1 PCB on a Lolin C3 Mini
+struct LolinC3Board {
+  static constexpr int encoderClk = 2;
+  static constexpr int encoderDt = 3;
+  static constexpr int encoderSw = 10;
+  static constexpr int i2cSda = 8;
+  static constexpr int i2cScl = 9;
+  static constexpr int fanPin = 5;
+  static constexpr int heaterPin = 21;
+  static constexpr int vaporizerPin = 0;
+  static constexpr int coolerPin = NO_PIN;
+  static constexpr uint8_t bme280Address = 0x76;  // Default I2C address for BME280
+};
+
+// v1.1 PCB with a Peltier module driver wired to GPIO 6
+struct LolinC3PeltierBoard : LolinC3Board {
+  static constexpr int coolerPin = 6;
+};
+
+// Control policies
+
+// Fan on software PWM with a kick-start pulse
+struct SoftPwmFan {
+  static constexpr unsigned long period = 100;          // Software PWM period in ms (10 Hz)
+  static constexpr int pwmMin = 0;                      // Minimum PWM for slow operation
+  static constexpr int pwmStart = 50;                   // PWM value to start the fan (kick-start)
+  static constexpr int pwmMax = 255;                    // Max PWM
+  static constexpr unsigned long kickStartDuration = 1000;  // Kick-start duration in milliseconds
+};
+
+// Heater on a MOSFET driven by software PWM
+struct PwmHeater {
+  static constexpr bool pwm = true;
+  static constexpr unsigned long period = 100;  // Software PWM period in ms
+  static constexpr int pwmMin = 0;              // No minimum for heater
+  static constexpr int pwmMax = 255;            // Max PWM for heater
+  static constexpr int thresholdLow = 1;        // Minimum degrees below target to turn on heater
+};
+
+// Heater on a mechanical relay: switched on/off, never faster than period
+struct RelayHeater {
+  static constexpr bool pwm = false;
+  static constexpr unsigned long period = 30000;  // Minimum time between relay switches in ms
+  static constexpr int pwmMin = 0;
+  static constexpr int pwmMax = 255;
+  static constexpr int thresholdLow = 1;
+};
+
+// Ultrasonic vaporizer switched with a humidity hysteresis
+struct Vaporizer {
+  static constexpr bool enabled = true;
+  static constexpr float hysteresis = 2.0f;  // Percent around target before switching
+};
+
+// No humidifier fitted
+struct NoVaporizer {
+  static constexpr bool enabled = false;
+  static constexpr float hysteresis = 0.0f;
+};
+
+// Peltier module driven by software PWM
+struct PeltierCooler {
+  static constexpr bool enabled = true;
+  static constexpr unsigned long period = 1000;  // Software PWM period in ms
+  static constexpr int pwmMax = 255;
+  static constexpr int thresholdHigh = 1;        // Minimum degrees above target to turn on cooler
+};
+
+// No active cooling, the fan exchanges air instead
+struct NoCooler {
+  static constexpr bool enabled = false;
+  static constexpr unsigned long period = 0;
+  static constexpr int pwmMax = 0;
+  static constexpr int thresholdHigh = 0;
+};
+
+constexpr bool pinsAreDistinct(const int* pins, int count) {
+  for (int i = 0; i < count; i++) {
+    for (int j = i + 1; j < count; j++) {
+      if (pins[i] != NO_PIN && pins[i] == pins[j]) return false;
+    }
+  }
+  return true;
+}
+
+// A build variant: board plus one policy per actuator, validated at compile time
+template <typename BoardT, typename FanT, typename HeaterT, typename VaporizerT, typename CoolerT>
+struct ChamberConfig {
+  using Board = BoardT;
+  using Fan = FanT;
+  using Heater = HeaterT;
+  using Humidifier = VaporizerT;
+  using Cooler = CoolerT;
+
+  static constexpr bool hasVaporizer = VaporizerT::enabled;
+  static constexpr bool hasCooler = CoolerT::enabled;
+  static constexpr int vaporizerPin = hasVaporizer ? BoardT::vaporizerPin : NO_PIN;
+  static constexpr int coolerPin = hasCooler ? BoardT::coolerPin : NO_PIN;
+
+  static constexpr int usedPins[] = {
+    BoardT::encoderClk, BoardT::encoderDt, BoardT::encoderSw, BoardT::i2cSda, BoardT::i2cScl,
+    BoardT::fanPin, BoardT::heaterPin, vaporizerPin, coolerPin
+  };
+
+  static_assert(pinsAreDistinct(usedPins, sizeof(usedPins) / sizeof(usedPins[0])), "board assigns one pin to several functions");
+  static_assert(BoardT::fanPin != NO_PIN && BoardT::heaterPin != NO_PIN, "fan and heater pins are required");
+  static_assert(!hasVaporizer || BoardT::vaporizerPin != NO_PIN, "vaporizer policy needs a vaporizer pin on the board");
+  static_assert(!hasCooler || BoardT::coolerPin != NO_PIN, "cooler policy needs a cooler pin on the board");
+  static_assert(FanT::pwmMin >= 0 && FanT::pwmMin <= FanT::pwmMax && FanT::pwmMax <= 255, "fan PWM range must lie within 0..255");
+  static_assert(FanT::pwmStart <= FanT::pwmMax, "fan kick-start must not exceed the fan PWM max");
+  static_assert(FanT::period > 0, "fan PWM period must be positive");
+  static_assert(HeaterT::pwmMin >= 0 && HeaterT::pwmMin <= HeaterT::pwmMax && HeaterT::pwmMax <= 255, "heater PWM range must lie within 0..255");
+  static_assert(HeaterT::period > 0, "heater period must be positive");
+  static_assert(HeaterT::thresholdLow > 0, "heater threshold must be above zero");
+  static_assert(!hasCooler || (CoolerT::thresholdHigh > 0 && CoolerT::pwmMax <= 255 && CoolerT::period > 0), "cooler needs a positive threshold and period and a PWM max within 0..255");
+};
+
+// Build variants, selected with a CHAMBER_VARIANT_* build flag
+using StandardChamber = ChamberConfig<LolinC3Board, SoftPwmFan, PwmHeater, Vaporizer, NoCooler>;
+using RelayHeaterChamber = ChamberConfig<LolinC3Board, SoftPwmFan, RelayHeater, Vaporizer, NoCooler>;
+using NoVaporizerChamber = ChamberConfig<LolinC3Board, SoftPwmFan, PwmHeater, NoVaporizer, NoCooler>;
+using PeltierChamber = ChamberConfig<LolinC3PeltierBoard, SoftPwmFan, PwmHeater, Vaporizer, PeltierCooler>;
+
+// Instantiate every variant so each build checks all of them, not only the selected one
+static_assert(sizeof(StandardChamber) > 0, "StandardChamber failed validation");
+static_assert(sizeof(RelayHeaterChamber) > 0, "RelayHeaterChamber failed validation");
+static_assert(sizeof(NoVaporizerChamber) > 0, "NoVaporizerChamber failed validation");
+static_assert(sizeof(PeltierChamber) > 0, "PeltierChamber failed validation");
+
+#if defined(CHAMBER_VARIANT_RELAY_HEATER)
+using Chamber = RelayHeaterChamber;
+#elif defined(CHAMBER_VARIANT_NO_VAPORIZER)
+using Chamber = NoVaporizerChamber;
+#elif defined(CHAMBER_VARIANT_PELTIER)
+using Chamber = PeltierChamber;
+#else
+using Chamber = StandardChamber;
+#endif
 
 // Range limits
-#define TEMP_MIN 0
-#define TEMP_MAX 40
-#define HUM_MIN 0
-#define HUM_MAX 100
-#define TIMER_MIN 0
-#define TIMER_MAX 999999  // Max timer in seconds (about 11.5 days)
-#define TIMER_STEP 300    // 5 minutes in seconds
+constexpr int TEMP_MIN = 0;
+constexpr int TEMP_MAX = 40;
+constexpr int HUM_MIN = 0;
+constexpr int HUM_MAX = 100;
+constexpr unsigned long TIMER_MIN = 0;
+constexpr unsigned long TIMER_MAX = 999999;  // Max timer in seconds (about 11.5 days)
+constexpr unsigned long TIMER_STEP = 300;    // 5 minutes in seconds
 
 // Timing constants
-#define BUTTON_DEBOUNCE_TIME 50
-#define BUTTON_LONG_PRESS_TIME 1000  // Long press threshold in ms
-#define ROTARY_ENCODER_STEPS 4
-#define SENSOR_READ_INTERVAL 500 // Read sensors every 500ms
+constexpr unsigned long BUTTON_DEBOUNCE_TIME = 50;
+constexpr unsigned long BUTTON_LONG_PRESS_TIME = 1000;  // Long press threshold in ms
+constexpr int ROTARY_ENCODER_STEPS = 4;
+constexpr unsigned long SENSOR_READ_INTERVAL = 500;  // Read sensors every 500ms
+
+// Menu pages
+constexpr int MENU_COUNT = 4;
+constexpr int MENU_HISTORY = 3;  // History graph page
+
+// History graph
+constexpr int HISTORY_COLUMNS = 128;       // One min/max bucket per display pixel column
+constexpr int HISTORY_WINDOW_COUNT = 3;    // Selectable windows, see HISTORY_WINDOW_SECONDS
+constexpr int HISTORY_TEMP_MIN_SPAN = 20;  // Minimum temperature plot span in tenths of a degree
+constexpr int HISTORY_HUM_MIN_SPAN = 50;   // Minimum humidity plot span in tenths of a percent
 
 #endif // CONFIG_H 
\ No newline at end of file
@@ -4,14 +4,17 @@
 #include "types.h"
 
 // Function declarations for control operations
-int calculateFanSpeed(const SystemState& state, const VaporizerState& vaporizerState);
-int calculateFanSpeedForDisplay(const SystemState& state);
-int calculateHeaterPower(const SystemState& state);
-bool calculateVaporizerState(const SystemState& state, const VaporizerState& vaporizerState);
+int calculateFanSpeed(const ControlState& control, const VaporizerState& vaporizerState);
+int calculateFanSpeedForDisplay(const ControlState& control);
+int calculateHeaterPower(const ControlState& control);
+bool calculateVaporizerState(const ControlState& control, const VaporizerState& vaporizerState);
 FanPwmState updateFanPwm(int fanPwmValue, const FanPwmState& pwmState);
-HeaterPwmState updateHeaterPwm(int heaterPwmValue, const HeaterPwmState& pwmState);
+SoftPwmState updateSoftPwm(int pwmValue, const SoftPwmState& pwmState);
+SoftPwmState updateHeaterPwm(int heaterPwmValue, const SoftPwmState& pwmState);
+int calculateCoolerPower(const ControlState& control);
 void applyFanOutput(bool isOn);
 void applyHeaterOutput(bool isOn);
 void applyVaporizerOutput(bool isOn);
+void applyCoolerOutput(bool isOn);
 
 #endif // CONTROLS_H 
\ No newline at end of file
@@ -2,8 +2,12 @@
 #define DISPLAY_H
 
 #include "types.h"
+#include "history.h"
 
-// Function declarations for display operations
-void updateDisplay(const SystemState& state, const VaporizerState& vaporizerState);
+// Redraws the full frame for the selected menu page and sends it to the panel
+void updateDisplay(const SystemState& state, const VaporizerState& vaporizerState, const SoftPwmState& heaterState, const History& history);
+
+// Redraws only the history plot area and pushes just those tiles to the panel
+void updateHistoryPlot(const SystemState& state, const History& history);
 
 #endif // DISPLAY_H 
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stdint.h>
+#include "types.h"
+#include "config.h"
+
+// Length in seconds of each selectable history window (1 h, 6 h, 24 h)
+extern const unsigned long HISTORY_WINDOW_SECONDS[HISTORY_WINDOW_COUNT];
+
+// Min/max of all samples that fell into one pixel column, in tenths; empty while tempMin > tempMax
+struct HistoryBucket {
+  int16_t tempMin;
+  int16_t tempMax;
+  int16_t humMin;
+  int16_t humMax;
+};
+
+// Ring of per-column buckets for one window; head is the column currently being filled
+struct HistoryWindow {
+  HistoryBucket buckets[HISTORY_COLUMNS];
+  unsigned long columnStart;
+  uint8_t head;
+};
+
+// Decimated history for every window, updated incrementally as samples arrive
+struct History {
+  HistoryWindow windows[HISTORY_WINDOW_COUNT];
+  unsigned long lastSampleTime;
+};
+
+// Plot range of one series in tenths, covering the visible buckets and the target
+struct HistoryRange {
+  int16_t low;
+  int16_t high;
+};
+
+// Clears all windows and starts their first column at now
+void resetHistory(History& history, unsigned long now);
+
+// Folds a sensor sample into the current column of every window, advancing columns as time passes.
+// Returns a bit mask of the windows whose visible columns changed.
+uint8_t recordSample(History& history, const ControlState& control, unsigned long now);
+
+// Returns the bucket shown in pixel column x (0 is oldest, HISTORY_COLUMNS - 1 is the current column)
+const HistoryBucket& bucketAt(const HistoryWindow& window, int x);
+
+// Returns true if no sample fell into the bucket
+bool isBucketEmpty(const HistoryBucket& bucket);
+
+// Computes the temperature plot range of a window in a single pass over its columns
+HistoryRange temperatureRange(const HistoryWindow& window, int tempTarget);
+
+// Computes the humidity plot range of a window in a single pass over its columns
+HistoryRange humidityRange(const HistoryWindow& window, int humTarget);
+
+#endif // HISTORY_H 
\ No newline at end of file
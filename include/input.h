@@ -2,11 +2,40 @@
 #define INPUT_H
 
 #include "types.h"
+#include "pipeline.h"
 
 // Function declarations for input operations
-SystemState processEncoder(const SystemState& state);
-SystemState processButton(const SystemState& state);
-SystemState clampValues(const SystemState& state);
+ControlState applyEncoderToControl(const ControlState& control, int menuIndex, int encoderValue);
+UiState applyEncoderToUi(const UiState& ui, int encoderValue);
+TimerState applyEncoderToTimer(const TimerState& timer, int encoderValue, unsigned long now);
+UiState advanceMenu(const UiState& ui, unsigned long now);
+ControlState clampControl(const ControlState& control);
+unsigned long clampTimerSeconds(unsigned long timerSeconds);
+int clampHistoryWindow(int historyWindow);
 void IRAM_ATTR readEncoderISR();
 
+// Pipeline stage: applies encoder rotation to the value of the selected menu
+struct EncoderStage {
+  static constexpr uint8_t reads = SLICE_UI | SLICE_TIMER;
+  static constexpr uint8_t writes = SLICE_CONTROL | SLICE_UI | SLICE_TIMER;
+  static constexpr bool polled = true;
+  static uint8_t apply(SystemState& state, unsigned long now);
+};
+
+// Pipeline stage: advances the menu on a debounced button click
+struct ButtonStage {
+  static constexpr uint8_t reads = SLICE_CONTROL | SLICE_UI | SLICE_TIMER;
+  static constexpr uint8_t writes = SLICE_UI | SLICE_TIMER;
+  static constexpr bool polled = true;
+  static uint8_t apply(SystemState& state, unsigned long now);
+};
+
+// Pipeline stage: clamps targets, timer and history window to their ranges, only after they were written
+struct ClampStage {
+  static constexpr uint8_t reads = SLICE_CONTROL | SLICE_UI | SLICE_TIMER;
+  static constexpr uint8_t writes = SLICE_CONTROL | SLICE_UI | SLICE_TIMER;
+  static constexpr bool polled = false;
+  static uint8_t apply(SystemState& state, unsigned long now);
+};
+
 #endif // INPUT_H 
\ No newline at end of file
@@ -4,7 +4,7 @@
 #include "types.h"
 
 // Function to initialize preferences and load stored values
-SystemState loadStoredSettings(const SystemState& state);
+ControlState loadStoredSettings(const ControlState& control);
 
 // Function to save individual target temperature
 void saveTargetTemperature(int tempTarget);
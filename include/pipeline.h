@@ -0,0 +1,44 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdint.h>
+#include "types.h"
+
+// Bit flags naming the SystemState slices a stage reads or writes
+enum StateSlice : uint8_t {
+  SLICE_NONE = 0,
+  SLICE_CONTROL = 1 << 0,
+  SLICE_UI = 1 << 1,
+  SLICE_TIMER = 1 << 2,
+  SLICE_SENSOR = 1 << 3,
+  SLICE_ALL = SLICE_CONTROL | SLICE_UI | SLICE_TIMER | SLICE_SENSOR
+};
+
+// Compile-time composed chain of stages that transform SystemState in place.
+// Each stage declares `reads`, `writes` and `polled`; a stage that is not polled
+// is skipped when none of the slices it reads were written earlier in the tick.
+// run() returns the mask of slices that changed during the tick.
+template <typename... Stages>
+struct Pipeline {
+  static uint8_t run(SystemState& state, unsigned long now) {
+    uint8_t dirty = SLICE_NONE;
+    ((dirty |= runStage<Stages>(state, now, dirty)), ...);
+    return dirty;
+  }
+
+private:
+  template <typename Stage>
+  static uint8_t runStage(SystemState& state, unsigned long now, uint8_t dirty) {
+    static_assert((Stage::reads & ~SLICE_ALL) == 0, "stage reads an unknown slice");
+    static_assert((Stage::writes & ~SLICE_ALL) == 0, "stage writes an unknown slice");
+    static_assert(Stage::writes != SLICE_NONE, "stage must write at least one slice");
+    static_assert(Stage::polled || Stage::reads != SLICE_NONE, "unpolled stage must read a slice");
+
+    if constexpr (!Stage::polled) {
+      if ((dirty & Stage::reads) == SLICE_NONE) return SLICE_NONE;
+    }
+    return Stage::apply(state, now) & Stage::writes;
+  }
+};
+
+#endif // PIPELINE_H 
\ No newline at end of file
@@ -2,9 +2,18 @@
 #define SENSORS_H
 
 #include "types.h"
+#include "pipeline.h"
 
 // Function declarations for sensor operations
-SystemState readSensors(const SystemState& state);
+ControlState readSensors(const ControlState& control);
 float compensateHumidity(float rawHumidity);
 
+// Pipeline stage: refreshes the control slice every SENSOR_READ_INTERVAL
+struct SensorStage {
+  static constexpr uint8_t reads = SLICE_CONTROL | SLICE_SENSOR;
+  static constexpr uint8_t writes = SLICE_CONTROL | SLICE_SENSOR;
+  static constexpr bool polled = true;
+  static uint8_t apply(SystemState& state, unsigned long now);
+};
+
 #endif // SENSORS_H 
\ No newline at end of file
@@ -2,8 +2,18 @@
 #define TIMER_H
 
 #include "types.h"
+#include "pipeline.h"
 
 // Function declarations for timer operations
-SystemState updateTimer(const SystemState& state);
+TimerState updateTimer(const TimerState& timer, unsigned long now);
+TimerState startTimer(const TimerState& timer, unsigned long now);
+
+// Pipeline stage: counts down the running timer, reporting a change once per second
+struct TimerStage {
+  static constexpr uint8_t reads = SLICE_TIMER;
+  static constexpr uint8_t writes = SLICE_TIMER;
+  static constexpr bool polled = true;
+  static uint8_t apply(SystemState& state, unsigned long now);
+};
 
 #endif // TIMER_H 
\ No newline at end of file
@@ -1,24 +1,45 @@
 #ifndef TYPES_H
 #define TYPES_H
 
-// State structure to hold all system state
-struct SystemState {
+// Hot control slice: read by the controllers and the display on every tick
+struct ControlState {
+  float temperature;
+  float humidity;
   int tempTarget;
   int humTarget;
-  int menuIndex;
-  float humidity;
-  float temperature;
   bool sensorReadSuccess;
-  unsigned long lastButtonPress;
+};
+
+// Sensor bookkeeping slice: when the control slice was last refreshed
+struct SensorState {
   unsigned long lastSensorRead;
-  int lastEncoderValue;
+};
+
+// UI and bookkeeping slice: only touched on input events
+struct UiState {
+  unsigned long lastButtonPress;
   unsigned long buttonPressStart;    // When button was first pressed
+  int menuIndex;
+  int lastEncoderValue;
+  int historyWindow;                 // Selected history graph window (index into HISTORY_WINDOW_SECONDS)
+};
+
+// Timer slice: touched on timer edits and once per second while counting down
+struct TimerState {
   unsigned long timerSeconds;        // Timer countdown in seconds (remaining time)
   unsigned long timerOriginalSeconds; // Original timer duration
   unsigned long timerStartTime;      // When timer was started (millis())
   bool timerRunning;                 // Whether timer is actively counting down
 };
 
+// State structure to hold all system state, split into hot and cold slices
+struct SystemState {
+  ControlState control;
+  UiState ui;
+  TimerState timer;
+  SensorState sensor;
+};
+
 // Fan PWM state structure
 struct FanPwmState {
   unsigned long lastCycleStart;
@@ -27,8 +48,8 @@ struct FanPwmState {
   unsigned long lastStartTime;  // When fan was last started (for kick-start)
 };
 
-// Heater PWM state structure
-struct HeaterPwmState {
+// Software PWM state structure, shared by heater and cooler
+struct SoftPwmState {
   unsigned long lastCycleStart;
   unsigned long period;
   bool isOn;
@@ -2,90 +2,113 @@
 #include "controls.h"
 #include "config.h"
 
-int calculateFanSpeed(const SystemState& state, const VaporizerState& vaporizerState) {
-  int fanPwm = FAN_PWM_MIN;
+using Board = Chamber::Board;
+using Fan = Chamber::Fan;
+using Heater = Chamber::Heater;
+using Humidifier = Chamber::Humidifier;
+using Cooler = Chamber::Cooler;
+
+int calculateFanSpeed(const ControlState& control, const VaporizerState& vaporizerState) {
+  int fanPwm = Fan::pwmMin;
   
-  if (state.sensorReadSuccess) {
-    float tempDiff = state.temperature - state.tempTarget;
-    float humDiff = state.humidity - state.humTarget;
-    float tempDeficit = state.tempTarget - state.temperature;
+  if (control.sensorReadSuccess) {
+    float tempDiff = control.temperature - control.tempTarget;
+    float humDiff = control.humidity - control.humTarget;
+    float tempDeficit = control.tempTarget - control.temperature;
     
     if (tempDiff > 0) {
-      fanPwm = FAN_PWM_MIN + int((FAN_PWM_MAX - FAN_PWM_MIN) * min(tempDiff, 10.0f) / 10.0f);
+      fanPwm = Fan::pwmMin + int((Fan::pwmMax - Fan::pwmMin) * min(tempDiff, 10.0f) / 10.0f);
     } else if (humDiff > 0) {
-      if (tempDeficit >= TEMP_THRESHOLD_LOW) {
-        fanPwm = FAN_PWM_MIN;
+      if (tempDeficit >= Heater::thresholdLow) {
+        fanPwm = Fan::pwmMin;
       } else {
-        int baseFanPwm = FAN_PWM_MIN + int((FAN_PWM_MAX - FAN_PWM_MIN) * min(humDiff, 50.0f) / 50.0f);
-        if (humDiff > 2.0f && !vaporizerState.isOn) {
-          fanPwm = min(FAN_PWM_MAX, baseFanPwm + 50);
+        int baseFanPwm = Fan::pwmMin + int((Fan::pwmMax - Fan::pwmMin) * min(humDiff, 50.0f) / 50.0f);
+        bool boostFan = false;
+        if constexpr (Chamber::hasVaporizer) {
+          boostFan = humDiff > Humidifier::hysteresis && !vaporizerState.isOn;
+        }
+        if (boostFan) {
+          fanPwm = min(Fan::pwmMax, baseFanPwm + 50);
         } else {
           fanPwm = baseFanPwm;
         }
       }
-    } else if (tempDeficit >= TEMP_THRESHOLD_LOW) {
-      fanPwm = FAN_PWM_MIN;
+    } else if (tempDeficit >= Heater::thresholdLow) {
+      fanPwm = Fan::pwmMin;
     }
   }
   
   return fanPwm;
 }
 
-int calculateFanSpeedForDisplay(const SystemState& state) {
-  int fanPwm = FAN_PWM_MIN;
+int calculateFanSpeedForDisplay(const ControlState& control) {
+  int fanPwm = Fan::pwmMin;
   
-  if (state.sensorReadSuccess) {
-    float tempDiff = state.temperature - state.tempTarget;
-    float humDiff = state.humidity - state.humTarget;
-    float tempDeficit = state.tempTarget - state.temperature;
+  if (control.sensorReadSuccess) {
+    float tempDiff = control.temperature - control.tempTarget;
+    float humDiff = control.humidity - control.humTarget;
+    float tempDeficit = control.tempTarget - control.temperature;
     
     if (tempDiff > 0) {
-      fanPwm = FAN_PWM_MIN + int((FAN_PWM_MAX - FAN_PWM_MIN) * min(tempDiff, 10.0f) / 10.0f);
+      fanPwm = Fan::pwmMin + int((Fan::pwmMax - Fan::pwmMin) * min(tempDiff, 10.0f) / 10.0f);
     } else if (humDiff > 0) {
-      if (tempDeficit >= TEMP_THRESHOLD_LOW) {
-        fanPwm = FAN_PWM_MIN;
+      if (tempDeficit >= Heater::thresholdLow) {
+        fanPwm = Fan::pwmMin;
       } else {
-        fanPwm = FAN_PWM_MIN + int((FAN_PWM_MAX - FAN_PWM_MIN) * min(humDiff, 50.0f) / 50.0f);
+        fanPwm = Fan::pwmMin + int((Fan::pwmMax - Fan::pwmMin) * min(humDiff, 50.0f) / 50.0f);
       }
-    } else if (tempDeficit >= TEMP_THRESHOLD_LOW) {
-      fanPwm = FAN_PWM_MIN;
+    } else if (tempDeficit >= Heater::thresholdLow) {
+      fanPwm = Fan::pwmMin;
     }
   }
   
   return fanPwm;
 }
 
-int calculateHeaterPower(const SystemState& state) {
+int calculateHeaterPower(const ControlState& control) {
   int heaterPwm = 0;
   
-  if (state.sensorReadSuccess) {
-    float tempDiff = state.tempTarget - state.temperature;
+  if (control.sensorReadSuccess) {
+    float tempDiff = control.tempTarget - control.temperature;
     
-    if (tempDiff >= TEMP_THRESHOLD_LOW) {
-      heaterPwm = HEATER_PWM_MIN + int((HEATER_PWM_MAX - HEATER_PWM_MIN) * min(tempDiff, 2.0f) / 2.0f);
+    if (tempDiff >= Heater::thresholdLow) {
+      if constexpr (Heater::pwm) {
+        heaterPwm = Heater::pwmMin + int((Heater::pwmMax - Heater::pwmMin) * min(tempDiff, 2.0f) / 2.0f);
+      } else {
+        heaterPwm = Heater::pwmMax;
+      }
     }
   }
   
   return heaterPwm;
 }
 
-bool calculateVaporizerState(const SystemState& state, const VaporizerState& vaporizerState) {
-  if (!state.sensorReadSuccess) {
+bool calculateVaporizerState(const ControlState& control, const VaporizerState& vaporizerState) {
+  if constexpr (!Chamber::hasVaporizer) {
+    return false;
+  }
+  
+  if (!control.sensorReadSuccess) {
     return vaporizerState.isOn;
   }
   
-  float humDiff = state.humidity - state.humTarget;
-  float humDeficit = state.humTarget - state.humidity;
+  float humDiff = control.humidity - control.humTarget;
+  float humDeficit = control.humTarget - control.humidity;
   
-  if (humDeficit > 2.0f) {
+  if (humDeficit > Humidifier::hysteresis) {
     return true;
-  } else if (humDiff > 2.0f) {
+  } else if (humDiff > Humidifier::hysteresis) {
     return false;
   } else {
     return vaporizerState.isOn;
   }
 }
 
+static bool softPwmOutput(int pwmValue, unsigned long cycleTime, unsigned long period) {
+  unsigned long onTime = (pwmValue * period) / 255;
+  return cycleTime < onTime;
+}
+
 FanPwmState updateFanPwm(int fanPwmValue, const FanPwmState& pwmState) {
   FanPwmState newState = pwmState;
   unsigned long now = millis();
@@ -103,27 +126,26 @@ FanPwmState updateFanPwm(int fanPwmValue, const FanPwmState& pwmState) {
   if (shouldBeOn && !pwmState.isOn) {
     // Fan is starting - use kick-start power
     newState.lastStartTime = now;
-    effectivePwm = FAN_PWM_START;
+    effectivePwm = Fan::pwmStart;
   } else if (shouldBeOn && pwmState.isOn) {
     // Fan is running - check if kick-start period is over
     unsigned long timeSinceStart = now - pwmState.lastStartTime;
-    if (timeSinceStart < FAN_KICK_START_DURATION) {
+    if (timeSinceStart < Fan::kickStartDuration) {
       // Still in kick-start period
-      effectivePwm = FAN_PWM_START;
+      effectivePwm = Fan::pwmStart;
     } else {
       // Kick-start period over, use normal PWM
       effectivePwm = fanPwmValue;
     }
   }
 
-  unsigned long onTime = (effectivePwm * pwmState.period) / 255;
-  newState.isOn = (cycleTime < onTime);
+  newState.isOn = softPwmOutput(effectivePwm, cycleTime, pwmState.period);
   
   return newState;
 }
 
-HeaterPwmState updateHeaterPwm(int heaterPwmValue, const HeaterPwmState& pwmState) {
-  HeaterPwmState newState = pwmState;
+SoftPwmState updateSoftPwm(int pwmValue, const SoftPwmState& pwmState) {
+  SoftPwmState newState = pwmState;
   unsigned long now = millis();
   unsigned long cycleTime = now - pwmState.lastCycleStart;
 
@@ -132,20 +154,60 @@ HeaterPwmState updateHeaterPwm(int heaterPwmValue, const HeaterPwmState& pwmStat
     cycleTime = 0;
   }
 
-  unsigned long onTime = (heaterPwmValue * pwmState.period) / 255;
-  newState.isOn = (cycleTime < onTime);
+  newState.isOn = softPwmOutput(pwmValue, cycleTime, pwmState.period);
   
   return newState;
 }
 
+SoftPwmState updateHeaterPwm(int heaterPwmValue, const SoftPwmState& pwmState) {
+  if constexpr (Heater::pwm) {
+    return updateSoftPwm(heaterPwmValue, pwmState);
+  }
+
+  // Relay: only switch once the minimum switch interval has passed
+  SoftPwmState newState = pwmState;
+  unsigned long now = millis();
+  bool shouldBeOn = (heaterPwmValue > 0);
+  if (shouldBeOn != pwmState.isOn && now - pwmState.lastCycleStart >= pwmState.period) {
+    newState.isOn = shouldBeOn;
+    newState.lastCycleStart = now;
+  }
+  
+  return newState;
+}
+
+int calculateCoolerPower(const ControlState& control) {
+  int coolerPwm = 0;
+  
+  if constexpr (Chamber::hasCooler) {
+    if (control.sensorReadSuccess) {
+      float tempExcess = control.temperature - control.tempTarget;
+      
+      if (tempExcess >= Cooler::thresholdHigh) {
+        coolerPwm = int(Cooler::pwmMax * min(tempExcess, 2.0f) / 2.0f);
+      }
+    }
+  }
+  
+  return coolerPwm;
+}
+
 void applyFanOutput(bool isOn) {
-  digitalWrite(FAN_PIN, isOn ? HIGH : LOW);
+  digitalWrite(Board::fanPin, isOn ? HIGH : LOW);
 }
 
 void applyHeaterOutput(bool isOn) {
-  digitalWrite(HEATER_PIN, isOn ? HIGH : LOW);
+  digitalWrite(Board::heaterPin, isOn ? HIGH : LOW);
 }
 
 void applyVaporizerOutput(bool isOn) {
-  digitalWrite(VAPORIZER_PIN, isOn ? HIGH : LOW);
-} 
\ No newline at end of file
+  if constexpr (Chamber::hasVaporizer) {
+    digitalWrite(Chamber::vaporizerPin, isOn ? HIGH : LOW);
+  }
+}
+
+void applyCoolerOutput(bool isOn) {
+  if constexpr (Chamber::hasCooler) {
+    digitalWrite(Chamber::coolerPin, isOn ? HIGH : LOW);
+  }
+}
\ No newline at end of file
@@ -7,38 +7,124 @@
 // Global display instance
 extern U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2;
 
-void updateDisplay(const SystemState& state, const VaporizerState& vaporizerState) {
+static const int PLOT_TOP = 16;
+static const int PLOT_TILE_ROW = PLOT_TOP / 8;
+static const int TEMP_PLOT_TOP = PLOT_TOP;
+static const int TEMP_PLOT_HEIGHT = 23;
+static const int HUM_PLOT_TOP = 40;
+static const int HUM_PLOT_HEIGHT = 24;
+static const int STATUS_ITEMS = 2 + (Chamber::hasVaporizer ? 1 : 0) + (Chamber::hasCooler ? 1 : 0);
+static const int STATUS_SPACING = STATUS_ITEMS > 3 ? 32 : 43;
+static const char* const HISTORY_WINDOW_LABELS[HISTORY_WINDOW_COUNT] = {"1h", "6h", "24h"};
+
+static int plotY(int value, const HistoryRange& range, int top, int height) {
+  return top + (height - 1) - (value - range.low) * (height - 1) / (range.high - range.low);
+}
+
+static void drawRangeLabel(float value, int baseline) {
+  char label[8];
+  snprintf(label, sizeof(label), "%.1f", value);
+  
+  u8g2.setDrawColor(0);
+  u8g2.drawBox(0, baseline - 5, u8g2.getStrWidth(label) + 1, 6);
+  u8g2.setDrawColor(1);
+  u8g2.drawStr(0, baseline, label);
+}
+
+static void drawSeries(const HistoryWindow& window, bool temperature, int target, int top, int height) {
+  HistoryRange range = temperature ? temperatureRange(window, target) : humidityRange(window, target);
+  
+  int targetY = plotY(target * 10, range, top, height);
+  for (int x = 0; x < HISTORY_COLUMNS; x += 4) {
+    u8g2.drawPixel(x, targetY);
+  }
+  
+  for (int x = 0; x < HISTORY_COLUMNS; x++) {
+    const HistoryBucket& bucket = bucketAt(window, x);
+    if (isBucketEmpty(bucket)) continue;
+    
+    int yHigh = plotY(temperature ? bucket.tempMax : bucket.humMax, range, top, height);
+    int yLow = plotY(temperature ? bucket.tempMin : bucket.humMin, range, top, height);
+    u8g2.drawVLine(x, yHigh, yLow - yHigh + 1);
+  }
+  
+  u8g2.setFont(u8g2_font_4x6_tf);
+  drawRangeLabel(range.high / 10.0f, top + 5);
+  drawRangeLabel(range.low / 10.0f, top + height - 1);
+}
+
+static void drawHistoryPlot(const SystemState& state, const History& history) {
+  const HistoryWindow& window = history.windows[state.ui.historyWindow];
+  
+  u8g2.setDrawColor(0);
+  u8g2.drawBox(0, PLOT_TOP, 128, 64 - PLOT_TOP);
+  u8g2.setDrawColor(1);
+  
+  drawSeries(window, true, state.control.tempTarget, TEMP_PLOT_TOP, TEMP_PLOT_HEIGHT);
+  drawSeries(window, false, state.control.humTarget, HUM_PLOT_TOP, HUM_PLOT_HEIGHT);
+}
+
+static void drawHistoryPage(const SystemState& state, const History& history) {
+  u8g2.drawBox(0, 0, 128, 14);
+  u8g2.setDrawColor(0);
+  u8g2.setFont(u8g2_font_6x10_tf);
+  u8g2.setCursor(2, 11);
+  u8g2.print(HISTORY_WINDOW_LABELS[state.ui.historyWindow]);
+  u8g2.setCursor(34, 11);
+  u8g2.print("T:");
+  u8g2.print(state.control.tempTarget);
+  u8g2.print("C H:");
+  u8g2.print(state.control.humTarget);
+  u8g2.print("%");
+  u8g2.setDrawColor(1);
+  
+  drawHistoryPlot(state, history);
+}
+
+void updateHistoryPlot(const SystemState& state, const History& history) {
+  drawHistoryPlot(state, history);
+  u8g2.updateDisplayArea(0, PLOT_TILE_ROW, 16, 8 - PLOT_TILE_ROW);
+}
+
+void updateDisplay(const SystemState& state, const VaporizerState& vaporizerState, const SoftPwmState& heaterState, const History& history) {
   // Pure calculation of what to display, with side effects of actually updating display
   u8g2.clearBuffer();
+  
+  if (state.ui.menuIndex == MENU_HISTORY) {
+    drawHistoryPage(state, history);
+    u8g2.sendBuffer();
+    return;
+  }
+  
   u8g2.setFont(u8g2_font_courB12_tf);  // Larger font
 
   // Temp menu (line 1) - increased spacing
-  if (state.menuIndex == 0) u8g2.drawBox(0, 0, 128, 18);
+  if (state.ui.menuIndex == 0) u8g2.drawBox(0, 0, 128, 18);
   u8g2.setCursor(2, 15);
-  u8g2.setDrawColor(state.menuIndex == 0 ? 0 : 1);
-  u8g2.print(state.tempTarget);
+  u8g2.setDrawColor(state.ui.menuIndex == 0 ? 0 : 1);
+  u8g2.print(state.control.tempTarget);
   u8g2.print(" / ");
-  if (state.sensorReadSuccess) u8g2.print(state.temperature, 1);
+  if (state.control.sensorReadSuccess) u8g2.print(state.control.temperature, 1);
   else u8g2.print("--");
   u8g2.print("C");
   u8g2.setDrawColor(1);
 
   // Humidity menu (line 2) - increased spacing
-  if (state.menuIndex == 1) u8g2.drawBox(0, 18, 128, 18);
+  if (state.ui.menuIndex == 1) u8g2.drawBox(0, 18, 128, 18);
   u8g2.setCursor(2, 33);
-  u8g2.setDrawColor(state.menuIndex == 1 ? 0 : 1);
-  u8g2.print(state.humTarget);
+  u8g2.setDrawColor(state.ui.menuIndex == 1 ? 0 : 1);
+  u8g2.print(state.control.humTarget);
   u8g2.print(" / ");
-  if (state.sensorReadSuccess) u8g2.print(state.humidity, 1);
+  if (state.control.sensorReadSuccess) u8g2.print(state.control.humidity, 1);
   else u8g2.print("--");
   u8g2.print("%");
   u8g2.setDrawColor(1);
 
   // Timer display (line 3) - highlight when selected, increased spacing
-  if (state.menuIndex == 2) u8g2.drawBox(0, 36, 128, 18);
+  if (state.ui.menuIndex == 2) u8g2.drawBox(0, 36, 128, 18);
   u8g2.setCursor(2, 51);
-  u8g2.setDrawColor(state.menuIndex == 2 ? 0 : 1);
-  unsigned long totalSeconds = state.timerSeconds;
+  u8g2.setDrawColor(state.ui.menuIndex == 2 ? 0 : 1);
+  unsigned long totalSeconds = state.timer.timerSeconds;
   unsigned long days = totalSeconds / 86400;
   unsigned long hours = (totalSeconds % 86400) / 3600;
   unsigned long minutes = (totalSeconds % 3600) / 60;
@@ -57,18 +143,18 @@ void updateDisplay(const SystemState& state, const VaporizerState& vaporizerStat
   u8g2.print(seconds);
   u8g2.setDrawColor(1);
 
-  // Status indicators (bottom line) - Fan, Heater, and Vaporizer status
-  u8g2.setFont(u8g2_font_6x10_tf);  // Smaller font for status
+  // Status indicators (bottom line) - one per fitted actuator
+  u8g2.setFont(STATUS_ITEMS > 3 ? u8g2_font_5x7_tf : u8g2_font_6x10_tf);  // Smaller font for status
   u8g2.setCursor(2, 63);
   
   // Calculate current fan and heater values for display
-  int fanPwm = calculateFanSpeedForDisplay(state);
-  int heaterPwm = calculateHeaterPower(state);
+  int fanPwm = calculateFanSpeedForDisplay(state.control);
+  int heaterPwm = calculateHeaterPower(state.control);
   
   // Fan indicator
   u8g2.print("F:");
-  if (fanPwm > FAN_PWM_MIN) {
-    int fanPercent = map(fanPwm, FAN_PWM_MIN, FAN_PWM_MAX, 0, 100);
+  if (fanPwm > Chamber::Fan::pwmMin) {
+    int fanPercent = map(fanPwm, Chamber::Fan::pwmMin, Chamber::Fan::pwmMax, 0, 100);
     u8g2.print(fanPercent);
     u8g2.print("%");
   } else {
@@ -76,20 +162,39 @@ void updateDisplay(const SystemState& state, const VaporizerState& vaporizerStat
   }
   
   // Heater indicator
-  u8g2.setCursor(45, 63);
+  u8g2.setCursor(2 + STATUS_SPACING, 63);
   u8g2.print("H:");
-  if (heaterPwm > 0) {
-    int heaterPercent = map(heaterPwm, 0, 255, 0, 100);
-    u8g2.print(heaterPercent);
-    u8g2.print("%");
+  if constexpr (Chamber::Heater::pwm) {
+    if (heaterPwm > 0) {
+      int heaterPercent = map(heaterPwm, 0, 255, 0, 100);
+      u8g2.print(heaterPercent);
+      u8g2.print("%");
+    } else {
+      u8g2.print("OFF");
+    }
   } else {
-    u8g2.print("OFF");
+    u8g2.print(heaterState.isOn ? "ON" : "OFF");
   }
   
   // Vaporizer indicator
-  u8g2.setCursor(88, 63);
-  u8g2.print("V:");
-  u8g2.print(vaporizerState.isOn ? "ON" : "OFF");
+  if constexpr (Chamber::hasVaporizer) {
+    u8g2.setCursor(2 + 2 * STATUS_SPACING, 63);
+    u8g2.print("V:");
+    u8g2.print(vaporizerState.isOn ? "ON" : "OFF");
+  }
+  
+  // Cooler indicator
+  if constexpr (Chamber::hasCooler) {
+    int coolerPwm = calculateCoolerPower(state.control);
+    u8g2.setCursor(2 + (STATUS_ITEMS - 1) * STATUS_SPACING, 63);
+    u8g2.print("C:");
+    if (coolerPwm > 0) {
+      u8g2.print(map(coolerPwm, 0, 255, 0, 100));
+      u8g2.print("%");
+    } else {
+      u8g2.print("OFF");
+    }
+  }
 
   u8g2.sendBuffer();
-} 
\ No newline at end of file
+}
\ No newline at end of file
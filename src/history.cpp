@@ -0,0 +1,120 @@
+#include <Arduino.h>
+#include "history.h"
+
+const unsigned long HISTORY_WINDOW_SECONDS[HISTORY_WINDOW_COUNT] = {3600, 21600, 86400};
+
+static const HistoryBucket EMPTY_BUCKET = {INT16_MAX, INT16_MIN, INT16_MAX, INT16_MIN};
+
+static unsigned long columnDuration(int windowIndex) {
+  return HISTORY_WINDOW_SECONDS[windowIndex] * 1000UL / HISTORY_COLUMNS;
+}
+
+static HistoryBucket extendBucket(const HistoryBucket& bucket, int16_t temp, int16_t hum) {
+  return {
+    min(bucket.tempMin, temp),
+    max(bucket.tempMax, temp),
+    min(bucket.humMin, hum),
+    max(bucket.humMax, hum)
+  };
+}
+
+static bool bucketsEqual(const HistoryBucket& a, const HistoryBucket& b) {
+  return a.tempMin == b.tempMin && a.tempMax == b.tempMax && a.humMin == b.humMin && a.humMax == b.humMax;
+}
+
+static bool advanceWindow(HistoryWindow& window, unsigned long duration, unsigned long now) {
+  unsigned long elapsedColumns = (now - window.columnStart) / duration;
+  if (elapsedColumns == 0) {
+    return false;
+  }
+  
+  unsigned long clearedColumns = min(elapsedColumns, (unsigned long)HISTORY_COLUMNS);
+  for (unsigned long i = 0; i < clearedColumns; i++) {
+    window.head = (window.head + 1) % HISTORY_COLUMNS;
+    window.buckets[window.head] = EMPTY_BUCKET;
+  }
+  window.columnStart += elapsedColumns * duration;
+  
+  return true;
+}
+
+void resetHistory(History& history, unsigned long now) {
+  for (HistoryWindow& window : history.windows) {
+    for (HistoryBucket& bucket : window.buckets) {
+      bucket = EMPTY_BUCKET;
+    }
+    window.columnStart = now;
+    window.head = HISTORY_COLUMNS - 1;
+  }
+  history.lastSampleTime = now;
+}
+
+uint8_t recordSample(History& history, const ControlState& control, unsigned long now) {
+  uint8_t changedWindows = 0;
+  history.lastSampleTime = now;
+  
+  for (int w = 0; w < HISTORY_WINDOW_COUNT; w++) {
+    HistoryWindow& window = history.windows[w];
+    bool changed = advanceWindow(window, columnDuration(w), now);
+    
+    if (control.sensorReadSuccess) {
+      HistoryBucket& bucket = window.buckets[window.head];
+      HistoryBucket extended = extendBucket(bucket,
+                                            (int16_t)lroundf(control.temperature * 10.0f),
+                                            (int16_t)lroundf(control.humidity * 10.0f));
+      changed = changed || !bucketsEqual(bucket, extended);
+      bucket = extended;
+    }
+    
+    if (changed) {
+      changedWindows |= 1 << w;
+    }
+  }
+  
+  return changedWindows;
+}
+
+const HistoryBucket& bucketAt(const HistoryWindow& window, int x) {
+  return window.buckets[(window.head + 1 + x) % HISTORY_COLUMNS];
+}
+
+bool isBucketEmpty(const HistoryBucket& bucket) {
+  return bucket.tempMin > bucket.tempMax;
+}
+
+static HistoryRange padRange(int low, int high, int minSpan) {
+  int span = high - low;
+  if (span < minSpan) {
+    low -= (minSpan - span) / 2;
+    high = low + minSpan;
+  }
+  return {(int16_t)low, (int16_t)high};
+}
+
+HistoryRange temperatureRange(const HistoryWindow& window, int tempTarget) {
+  int low = tempTarget * 10;
+  int high = tempTarget * 10;
+  
+  for (const HistoryBucket& bucket : window.buckets) {
+    if (!isBucketEmpty(bucket)) {
+      low = min(low, (int)bucket.tempMin);
+      high = max(high, (int)bucket.tempMax);
+    }
+  }
+  
+  return padRange(low, high, HISTORY_TEMP_MIN_SPAN);
+}
+
+HistoryRange humidityRange(const HistoryWindow& window, int humTarget) {
+  int low = humTarget * 10;
+  int high = humTarget * 10;
+  
+  for (const HistoryBucket& bucket : window.buckets) {
+    if (!isBucketEmpty(bucket)) {
+      low = min(low, (int)bucket.humMin);
+      high = max(high, (int)bucket.humMax);
+    }
+  }
+  
+  return padRange(low, high, HISTORY_HUM_MIN_SPAN);
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "input.h"
 #include "config.h"
 #include "persistence.h"
+#include "timer.h"
 
 // Global encoder instance
 extern AiEsp32RotaryEncoder rotaryEncoder;
@@ -11,84 +12,143 @@ void IRAM_ATTR readEncoderISR() {
   rotaryEncoder.readEncoder_ISR();
 }
 
-SystemState processEncoder(const SystemState& state) {
-  SystemState newState = state;
+ControlState applyEncoderToControl(const ControlState& control, int menuIndex, int encoderValue) {
+  ControlState newControl = control;
   
-  if (rotaryEncoder.encoderChanged()) {
-    int currentValue = rotaryEncoder.readEncoder();
-    
-    if (state.menuIndex == 0) {
-      // In temperature menu
-      newState.tempTarget = currentValue;
-      
-      // Save temperature target to preferences
-      saveTargetTemperature(newState.tempTarget);
-    } else if (state.menuIndex == 1) {
-      // In humidity menu
-      newState.humTarget = currentValue;
-      
-      // Save humidity target to preferences
-      saveTargetHumidity(newState.humTarget);
-    } else if (state.menuIndex == 2) {
-      // In timer menu - adjust in 5-minute steps
-      newState.timerSeconds = currentValue * TIMER_STEP;
-      newState.timerOriginalSeconds = newState.timerSeconds;
-      // If timer is running and we change the value, restart it
-      if (newState.timerRunning) {
-        newState.timerStartTime = millis();
-      }
-    }
-    
-    newState.lastEncoderValue = currentValue;
+  if (menuIndex == 0) {
+    newControl.tempTarget = encoderValue;
+  } else if (menuIndex == 1) {
+    newControl.humTarget = encoderValue;
   }
   
-  return newState;
+  return newControl;
 }
 
-SystemState processButton(const SystemState& state) {
-  SystemState newState = state;
+UiState applyEncoderToUi(const UiState& ui, int encoderValue) {
+  UiState newUi = ui;
+  
+  if (ui.menuIndex == MENU_HISTORY) {
+    newUi.historyWindow = encoderValue;
+  }
+  
+  newUi.lastEncoderValue = encoderValue;
   
-  if (rotaryEncoder.isEncoderButtonClicked()) {
-    unsigned long currentTime = millis();
+  return newUi;
+}
+
+TimerState applyEncoderToTimer(const TimerState& timer, int encoderValue, unsigned long now) {
+  TimerState newTimer = timer;
+  
+  // Adjust in 5-minute steps
+  newTimer.timerSeconds = encoderValue * TIMER_STEP;
+  newTimer.timerOriginalSeconds = newTimer.timerSeconds;
+  // If timer is running and we change the value, restart it
+  if (newTimer.timerRunning) {
+    newTimer.timerStartTime = now;
+  }
+  
+  return newTimer;
+}
+
+UiState advanceMenu(const UiState& ui, unsigned long now) {
+  UiState newUi = ui;
+  
+  newUi.menuIndex = (ui.menuIndex + 1) % MENU_COUNT;
+  newUi.lastButtonPress = now;
+  
+  return newUi;
+}
+
+ControlState clampControl(const ControlState& control) {
+  ControlState newControl = control;
+  
+  newControl.tempTarget = max(TEMP_MIN, min(newControl.tempTarget, TEMP_MAX));
+  newControl.humTarget = max(HUM_MIN, min(newControl.humTarget, HUM_MAX));
+  
+  return newControl;
+}
+
+unsigned long clampTimerSeconds(unsigned long timerSeconds) {
+  return max((unsigned long)TIMER_MIN, min(timerSeconds, (unsigned long)TIMER_MAX));
+}
+
+int clampHistoryWindow(int historyWindow) {
+  return max(0, min(historyWindow, HISTORY_WINDOW_COUNT - 1));
+}
+
+uint8_t EncoderStage::apply(SystemState& state, unsigned long now) {
+  if (!rotaryEncoder.encoderChanged()) {
+    return SLICE_NONE;
+  }
+  
+  int currentValue = rotaryEncoder.readEncoder();
+  
+  state.control = applyEncoderToControl(state.control, state.ui.menuIndex, currentValue);
+  state.ui = applyEncoderToUi(state.ui, currentValue);
+  if (state.ui.menuIndex == 2) {
+    state.timer = applyEncoderToTimer(state.timer, currentValue, now);
+  }
+  
+  // Save the edited target to preferences
+  if (state.ui.menuIndex == 0) {
+    saveTargetTemperature(state.control.tempTarget);
+  } else if (state.ui.menuIndex == 1) {
+    saveTargetHumidity(state.control.humTarget);
+  }
+  
+  return SLICE_CONTROL | SLICE_UI | SLICE_TIMER;
+}
+
+uint8_t ButtonStage::apply(SystemState& state, unsigned long now) {
+  if (!rotaryEncoder.isEncoderButtonClicked()) {
+    return SLICE_NONE;
+  }
+  
+  if (now - state.ui.lastButtonPress <= BUTTON_DEBOUNCE_TIME) {
+    return SLICE_NONE;
+  }
+  
+  state.ui = advanceMenu(state.ui, now);
+  
+  // Update encoder boundaries and value based on new menu selection
+  if (state.ui.menuIndex == 0) {
+    rotaryEncoder.setBoundaries(TEMP_MIN, TEMP_MAX, false);
+    rotaryEncoder.setEncoderValue(state.control.tempTarget);
+  } else if (state.ui.menuIndex == 1) {
+    rotaryEncoder.setBoundaries(HUM_MIN, HUM_MAX, false);
+    rotaryEncoder.setEncoderValue(state.control.humTarget);
+  } else if (state.ui.menuIndex == 2) {
+    rotaryEncoder.setBoundaries(TIMER_MIN, TIMER_MAX / TIMER_STEP, false);
+    rotaryEncoder.setEncoderValue(state.timer.timerSeconds / TIMER_STEP);
     
-    if (currentTime - state.lastButtonPress > BUTTON_DEBOUNCE_TIME) {
-      // For now, just implement short press (menu change)
-      // Long press can be added later with additional button state tracking
-      newState.menuIndex = (state.menuIndex + 1) % 3;
-      
-      // Update encoder boundaries and value based on new menu selection
-      if (newState.menuIndex == 0) {
-        rotaryEncoder.setBoundaries(TEMP_MIN, TEMP_MAX, false);
-        rotaryEncoder.setEncoderValue(newState.tempTarget);
-      } else if (newState.menuIndex == 1) {
-        rotaryEncoder.setBoundaries(HUM_MIN, HUM_MAX, false);
-        rotaryEncoder.setEncoderValue(newState.humTarget);
-      } else {
-        rotaryEncoder.setBoundaries(TIMER_MIN, TIMER_MAX / TIMER_STEP, false);
-        rotaryEncoder.setEncoderValue(newState.timerSeconds / TIMER_STEP);
-        
-        // Auto-start timer when entering timer menu if timer > 0 and not running
-        if (newState.timerSeconds > 0 && !newState.timerRunning) {
-          newState.timerRunning = true;
-          newState.timerOriginalSeconds = newState.timerSeconds;
-          newState.timerStartTime = currentTime;
-        }
-      }
-      
-      newState.lastButtonPress = currentTime;
-    }
+    // Auto-start timer when entering timer menu if timer > 0 and not running
+    state.timer = startTimer(state.timer, now);
+  } else {
+    rotaryEncoder.setBoundaries(0, HISTORY_WINDOW_COUNT - 1, false);
+    rotaryEncoder.setEncoderValue(state.ui.historyWindow);
   }
   
-  return newState;
+  return SLICE_UI | SLICE_TIMER;
 }
 
-SystemState clampValues(const SystemState& state) {
-  SystemState newState = state;
+uint8_t ClampStage::apply(SystemState& state, unsigned long) {
+  ControlState newControl = clampControl(state.control);
+  unsigned long timerSeconds = clampTimerSeconds(state.timer.timerSeconds);
+  int historyWindow = clampHistoryWindow(state.ui.historyWindow);
   
-  // Pure function that clamps values to allowed ranges
-  newState.tempTarget = max(TEMP_MIN, min(newState.tempTarget, TEMP_MAX));
-  newState.humTarget = max(HUM_MIN, min(newState.humTarget, HUM_MAX));
-  newState.timerSeconds = max((unsigned long)TIMER_MIN, min(newState.timerSeconds, (unsigned long)TIMER_MAX));
+  uint8_t changed = SLICE_NONE;
+  if (newControl.tempTarget != state.control.tempTarget || newControl.humTarget != state.control.humTarget) {
+    state.control = newControl;
+    changed |= SLICE_CONTROL;
+  }
+  if (timerSeconds != state.timer.timerSeconds) {
+    state.timer.timerSeconds = timerSeconds;
+    changed |= SLICE_TIMER;
+  }
+  if (historyWindow != state.ui.historyWindow) {
+    state.ui.historyWindow = historyWindow;
+    changed |= SLICE_UI;
+  }
   
-  return newState;
-} 
\ No newline at end of file
+  return changed;
+}
\ No newline at end of file
@@ -14,11 +14,13 @@
 #include "input.h"
 #include "timer.h"
 #include "persistence.h"
+#include "pipeline.h"
+#include "history.h"
 
 // Hardware initialization
 Adafruit_BME280 bme;
 U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
-AiEsp32RotaryEncoder rotaryEncoder = AiEsp32RotaryEncoder(ENCODER_DT, ENCODER_CLK, ENCODER_SW, -1, ROTARY_ENCODER_STEPS);
+AiEsp32RotaryEncoder rotaryEncoder = AiEsp32RotaryEncoder(Chamber::Board::encoderDt, Chamber::Board::encoderClk, Chamber::Board::encoderSw, -1, ROTARY_ENCODER_STEPS);
 
 // Function prototypes
 void setupHardware();
@@ -26,51 +28,97 @@ SystemState createInitialState();
 
 // Global state that can't be easily made functional due to hardware interactions
 SystemState state;
-FanPwmState fanState = {0, 1000/FAN_PWM_FREQ_SOFT, false, 0};  // Calculate proper period from frequency
-HeaterPwmState heaterState = {0, 1000/FAN_PWM_FREQ_SOFT, false};  // Use same period for heater
+FanPwmState fanState = {0, Chamber::Fan::period, false, 0};
+SoftPwmState heaterState = {0, Chamber::Heater::period, false};
+SoftPwmState coolerState = {0, Chamber::Cooler::period, false};
 VaporizerState vaporizerState = {false, 0};
+History history;
+
+// Input stages run in order once per tick, each transforming state in place
+using InputPipeline = Pipeline<SensorStage, EncoderStage, ButtonStage, ClampStage, TimerStage>;
 
 void setup() {
   setupHardware();
   state = createInitialState();
   
+  // Let the first heater switch through instead of waiting a full period after boot
+  heaterState.lastCycleStart = millis() - heaterState.period;
+  
   // Load stored settings from preferences
-  state = loadStoredSettings(state);
+  state.control = loadStoredSettings(state.control);
   
-  state = readSensors(state);
+  resetHistory(history, millis());
+  state.control = readSensors(state.control);
+  state.sensor.lastSensorRead = millis();
+  recordSample(history, state.control, state.sensor.lastSensorRead);
+  updateDisplay(state, vaporizerState, heaterState, history);
 }
 
 void loop() {
-  // Read sensors periodically based on time
-  if (millis() - state.lastSensorRead >= SENSOR_READ_INTERVAL) {
-    state = readSensors(state);
-  }
+#ifdef LOOP_PROFILING
+  uint32_t tickStartCycles = ESP.getCycleCount();
+#endif
 
-  // Process inputs and update state in a functional way
-  state = processEncoder(state);
-  state = processButton(state);
-  state = clampValues(state);
-  state = updateTimer(state);
+  uint8_t dirty = InputPipeline::run(state, millis());
   
   // Calculate outputs based on state
-  int fanPwm = calculateFanSpeed(state, vaporizerState);
-  int heaterPwm = calculateHeaterPower(state);
-  bool vaporizerOn = calculateVaporizerState(state, vaporizerState);
-  updateDisplay(state, vaporizerState);
+  int fanPwm = calculateFanSpeed(state.control, vaporizerState);
+  int heaterPwm = calculateHeaterPower(state.control);
+  bool vaporizerOn = calculateVaporizerState(state.control, vaporizerState);
   
   // Update fan and heater state and apply to hardware
   fanState = updateFanPwm(fanPwm, fanState);
+  bool heaterWasOn = heaterState.isOn;
   heaterState = updateHeaterPwm(heaterPwm, heaterState);
   applyFanOutput(fanState.isOn);
   applyHeaterOutput(heaterState.isOn);
-  applyVaporizerOutput(vaporizerOn);
+  
+  if constexpr (Chamber::hasCooler) {
+    coolerState = updateSoftPwm(calculateCoolerPower(state.control), coolerState);
+    applyCoolerOutput(coolerState.isOn);
+  }
+  
+  // A relay heater shows its switch state, so a flip needs a redraw
+  if constexpr (!Chamber::Heater::pwm) {
+    if (heaterState.isOn != heaterWasOn) {
+      dirty |= SLICE_CONTROL;
+    }
+  }
   
   // Update vaporizer state
-  if (vaporizerOn != vaporizerState.isOn) {
-    vaporizerState.isOn = vaporizerOn;
-    vaporizerState.lastStateChange = millis();
+  if constexpr (Chamber::hasVaporizer) {
+    applyVaporizerOutput(vaporizerOn);
+    if (vaporizerOn != vaporizerState.isOn) {
+      vaporizerState.isOn = vaporizerOn;
+      vaporizerState.lastStateChange = millis();
+      dirty |= SLICE_CONTROL;
+    }
   }
   
+  // Fold each new sensor reading into the history buckets
+  bool historyChanged = false;
+  if (state.sensor.lastSensorRead != history.lastSampleTime) {
+    uint8_t changedWindows = recordSample(history, state.control, state.sensor.lastSensorRead);
+    historyChanged = (changedWindows & (1 << state.ui.historyWindow)) != 0;
+  }
+  
+  // Only redraw when something shown on the current page changed this tick
+  if (state.ui.menuIndex == MENU_HISTORY) {
+    if (dirty & SLICE_UI) {
+      updateDisplay(state, vaporizerState, heaterState, history);
+    } else if (historyChanged) {
+      updateHistoryPlot(state, history);
+    }
+  } else if (dirty != SLICE_NONE) {
+    updateDisplay(state, vaporizerState, heaterState, history);
+  }
+  
+#ifdef LOOP_PROFILING
+  uint32_t tickCycles = ESP.getCycleCount() - tickStartCycles;
+  static uint32_t maxTickCycles = 0;
+  maxTickCycles = max(maxTickCycles, tickCycles);
+#endif
+
   // Debug output every 2 seconds
   static unsigned long lastDebug = 0;
   if (millis() - lastDebug > 2000) {
@@ -91,15 +139,24 @@ void loop() {
     Serial.print(", OnTime: ");
     Serial.print(onTime);
     Serial.print(", Temp: ");
-    Serial.print(state.temperature);
+    Serial.print(state.control.temperature);
     Serial.print(", Target: ");
-    Serial.print(state.tempTarget);
+    Serial.print(state.control.tempTarget);
     Serial.print(", Humidity: ");
-    Serial.print(state.humidity);
+    Serial.print(state.control.humidity);
     Serial.print(", HumTarget: ");
-    Serial.print(state.humTarget);
+    Serial.print(state.control.humTarget);
     Serial.print(", Vaporizer: ");
     Serial.println(vaporizerOn);
+#ifdef LOOP_PROFILING
+    Serial.print("TickCycles: ");
+    Serial.print(tickCycles);
+    Serial.print(", MaxTickCycles: ");
+    Serial.print(maxTickCycles);
+    Serial.print(", StackHighWater: ");
+    Serial.println(uxTaskGetStackHighWaterMark(NULL));
+    maxTickCycles = 0;
+#endif
     lastDebug = millis();
   }
   
@@ -110,11 +167,11 @@ void setupHardware() {
   Serial.begin(9600);
   delay(300);
   
-  Wire.begin(8, 9);
+  Wire.begin(Chamber::Board::i2cSda, Chamber::Board::i2cScl);
   u8g2.begin();
   
   // Initialize BME280 sensor
-  if (!bme.begin(BME280_I2C_ADDRESS)) {
+  if (!bme.begin(Chamber::Board::bme280Address)) {
     Serial.println("Could not find a valid BME280 sensor, check wiring!");
   } else {
     Serial.println("BME280 sensor found and initialized!");
@@ -127,30 +184,44 @@ void setupHardware() {
   rotaryEncoder.setBoundaries(TEMP_MIN, TEMP_MAX, circleValues);
   rotaryEncoder.setAcceleration(50);
   
-  pinMode(FAN_PIN, OUTPUT);
-  pinMode(HEATER_PIN, OUTPUT);
-  pinMode(VAPORIZER_PIN, OUTPUT);
+  pinMode(Chamber::Board::fanPin, OUTPUT);
+  pinMode(Chamber::Board::heaterPin, OUTPUT);
+  if constexpr (Chamber::hasVaporizer) {
+    pinMode(Chamber::vaporizerPin, OUTPUT);
+  }
+  if constexpr (Chamber::hasCooler) {
+    pinMode(Chamber::coolerPin, OUTPUT);
+  }
 }
 
 SystemState createInitialState() {
   SystemState newState = {
-    .tempTarget = 10,
-    .humTarget = 50,
-    .menuIndex = 0,
-    .humidity = 0,
-    .temperature = 0,
-    .sensorReadSuccess = false,
-    .lastButtonPress = 0,
-    .lastSensorRead = 0,
-    .lastEncoderValue = 10,
-    .buttonPressStart = 0,
-    .timerSeconds = 0,
-    .timerOriginalSeconds = 0,
-    .timerStartTime = 0,
-    .timerRunning = false
+    .control = {
+      .temperature = 0,
+      .humidity = 0,
+      .tempTarget = 10,
+      .humTarget = 50,
+      .sensorReadSuccess = false
+    },
+    .ui = {
+      .lastButtonPress = 0,
+      .buttonPressStart = 0,
+      .menuIndex = 0,
+      .lastEncoderValue = 10,
+      .historyWindow = 0
+    },
+    .timer = {
+      .timerSeconds = 0,
+      .timerOriginalSeconds = 0,
+      .timerStartTime = 0,
+      .timerRunning = false
+    },
+    .sensor = {
+      .lastSensorRead = 0
+    }
   };
   
-  rotaryEncoder.setEncoderValue(newState.tempTarget);
+  rotaryEncoder.setEncoderValue(newState.control.tempTarget);
   
   return newState;
 } 
\ No newline at end of file
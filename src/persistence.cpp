@@ -10,16 +10,16 @@ Preferences preferences;
 #define DEFAULT_TEMP_TARGET 10
 #define DEFAULT_HUM_TARGET 50
 
-SystemState loadStoredSettings(const SystemState& state) {
-  SystemState newState = state;
+ControlState loadStoredSettings(const ControlState& control) {
+  ControlState newControl = control;
   
   preferences.begin("fermentation", true);
   
-  newState.tempTarget = preferences.getInt("tempTarget", DEFAULT_TEMP_TARGET);
-  newState.humTarget = preferences.getInt("humTarget", DEFAULT_HUM_TARGET);
+  newControl.tempTarget = preferences.getInt("tempTarget", DEFAULT_TEMP_TARGET);
+  newControl.humTarget = preferences.getInt("humTarget", DEFAULT_HUM_TARGET);
   
   preferences.end();
-  return newState;
+  return newControl;
 }
 
 void saveTargetTemperature(int tempTarget) {
@@ -7,8 +7,8 @@
 // Global BME280 sensor instance
 extern Adafruit_BME280 bme;
 
-SystemState readSensors(const SystemState& state) {
-  SystemState newState = state;
+ControlState readSensors(const ControlState& control) {
+  ControlState newControl = control;
   
   // Read sensors from BME280
   float rawTemperature = bme.readTemperature();
@@ -16,16 +16,25 @@ SystemState readSensors(const SystemState& state) {
   
   // Check if readings are valid
   if (!isnan(rawTemperature) && !isnan(rawHumidity)) {
-    newState.temperature = rawTemperature;
-    newState.humidity = rawHumidity;
-    newState.sensorReadSuccess = true;
+    newControl.temperature = rawTemperature;
+    newControl.humidity = rawHumidity;
+    newControl.sensorReadSuccess = true;
   } else {
-    newState.humidity = rawHumidity;  // Keep NaN for error indication
-    newState.temperature = rawTemperature;
-    newState.sensorReadSuccess = false;
+    newControl.humidity = rawHumidity;  // Keep NaN for error indication
+    newControl.temperature = rawTemperature;
+    newControl.sensorReadSuccess = false;
   }
   
-  newState.lastSensorRead = millis();
+  return newControl;
+}
+
+uint8_t SensorStage::apply(SystemState& state, unsigned long now) {
+  if (now - state.sensor.lastSensorRead < SENSOR_READ_INTERVAL) {
+    return SLICE_NONE;
+  }
+  
+  state.control = readSensors(state.control);
+  state.sensor.lastSensorRead = now;
   
-  return newState;
+  return SLICE_CONTROL | SLICE_SENSOR;
 }
\ No newline at end of file
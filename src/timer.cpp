@@ -1,22 +1,45 @@
 #include <Arduino.h>
 #include "timer.h"
 
-SystemState updateTimer(const SystemState& state) {
-  SystemState newState = state;
+TimerState updateTimer(const TimerState& timer, unsigned long now) {
+  TimerState newTimer = timer;
   
-  if (newState.timerRunning && newState.timerOriginalSeconds > 0) {
-    unsigned long currentTime = millis();
-    unsigned long elapsedSeconds = (currentTime - newState.timerStartTime) / 1000;
+  if (newTimer.timerRunning && newTimer.timerOriginalSeconds > 0) {
+    unsigned long elapsedSeconds = (now - newTimer.timerStartTime) / 1000;
     
-    if (elapsedSeconds >= newState.timerOriginalSeconds) {
-      newState.timerSeconds = 0;
-      newState.timerRunning = false;
+    if (elapsedSeconds >= newTimer.timerOriginalSeconds) {
+      newTimer.timerSeconds = 0;
+      newTimer.timerRunning = false;
     } else {
-      newState.timerSeconds = newState.timerOriginalSeconds - elapsedSeconds;
+      newTimer.timerSeconds = newTimer.timerOriginalSeconds - elapsedSeconds;
     }
-  } else if (newState.timerRunning && newState.timerSeconds == 0) {
-    newState.timerRunning = false;
+  } else if (newTimer.timerRunning && newTimer.timerSeconds == 0) {
+    newTimer.timerRunning = false;
   }
   
-  return newState;
-} 
\ No newline at end of file
+  return newTimer;
+}
+
+TimerState startTimer(const TimerState& timer, unsigned long now) {
+  TimerState newTimer = timer;
+  
+  if (newTimer.timerSeconds > 0 && !newTimer.timerRunning) {
+    newTimer.timerRunning = true;
+    newTimer.timerOriginalSeconds = newTimer.timerSeconds;
+    newTimer.timerStartTime = now;
+  }
+  
+  return newTimer;
+}
+
+uint8_t TimerStage::apply(SystemState& state, unsigned long now) {
+  if (!state.timer.timerRunning) {
+    return SLICE_NONE;
+  }
+  
+  TimerState newTimer = updateTimer(state.timer, now);
+  bool changed = newTimer.timerSeconds != state.timer.timerSeconds || newTimer.timerRunning != state.timer.timerRunning;
+  state.timer = newTimer;
+  
+  return changed ? SLICE_TIMER : SLICE_NONE;
+}
\ No newline at end of file